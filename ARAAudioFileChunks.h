@@ -104,9 +104,27 @@ extern "C"
 //!     </audioSources>
 //! </ARA>
 //! \endcode
+//! \br
+//! In both RIFF-based (WAVE, RF64, BW64) and AIFF-based (AIFF, AIFC) files, the iXML document is
+//! stored in a chunk with the ID kARAIXMLChunkID. Note that chunk sizes are stored in little-endian
+//! byte order in RIFF files but in big-endian byte order in AIFF files, and that in both formats,
+//! chunks with an odd size are followed by a pad byte that is not included in the chunk size.
+//! The iXML document is UTF-8 encoded, and the \<ARA\> element is a direct child of its root element.
+//! \br
+//! To allow hosts to scan large audio libraries quickly without using a general-purpose XML parser,
+//! writers should encode the \<ARA\> sub-tree as plain elements as shown in the example above,
+//! without attributes, comments, processing instructions or CDATA sections, and should only use
+//! the predefined XML entities to escape characters in text values. The Base64 text of the
+//! #kARAXMLName_ArchiveData element never requires escaping, so readers can determine the byte range
+//! of the archive data within the file and decode it later on demand. Readers must nevertheless be
+//! prepared to handle any well-formed XML, e.g. by falling back to a full XML parser if encountering
+//! constructs other than the above, and must ignore any unknown elements.
 //! @{
 
 #if defined(__cplusplus)
+    //! ID of the audio file chunk that contains the iXML document, in RIFF and AIFF files alike.
+    constexpr auto kARAIXMLChunkID { "iXML" };
+
     //! Name of the XML element that contains the vendor-specific iXML sub-tree for ARA.
     constexpr auto kARAXMLName_ARAVendorKeyword { "ARA" };
 
@@ -144,6 +162,14 @@ extern "C"
     //! Name of the XML element inside an audio source archive that encodes the actual binary data
     //! of the archive in Base64 format, with the possible addition of line feeds as allowed by MIME.
     //! Note that it is preferred to encode without line feeds, but decoders must handle both cases.
+    //! The encoding uses the standard Base64 alphabet (not the URL-safe variant) including the
+    //! trailing '=' padding, so that the text length is always a multiple of 4 when ignoring line
+    //! feeds. Encoders that insert line feeds (either LF or CR LF) must only do so after complete
+    //! groups of 4 characters, such as after every 76 characters as done by MIME. Decoders must
+    //! ignore any XML whitespace (space, tab, CR and LF) in the text, including leading and trailing
+    //! whitespace that may be added when indenting the XML, and must reject any other characters.
+    //! These rules allow for decoding the data in a streaming fashion, processing blocks of 4
+    //! characters independently, and for estimating the size of the binary data as 3/4 of the text length.
     //! string value, see ARAArchivingControllerInterface, see https://tools.ietf.org/html/rfc4648.
     constexpr auto kARAXMLName_ArchiveData { "archiveData" };
 
@@ -157,6 +183,8 @@ extern "C"
     //! Name of the XML element inside a suggested plug-in element that encodes the plug-in information URL as string.
     constexpr auto kARAXMLName_InformationURL { "informationURL" };
 #else
+    #define kARAIXMLChunkID "iXML"
+
     #define kARAXMLName_ARAVendorKeyword "ARA"
 
     #define kARAXMLName_AudioSources "audioSources"
@@ -165,6 +193,7 @@ extern "C"
 
     #define kARAXMLName_DocumentArchiveID "documentArchiveID"
     #define kARAXMLName_OpenAutomatically "openAutomatically"
+    #define kARAXMLName_CreateDistinctAudioModification "createDistinctAudioModification"
     #define kARAXMLName_SuggestedPlugIn "suggestedPlugIn"
     #define kARAXMLName_PersistentID "persistentID"
     #define kARAXMLName_ArchiveData "archiveData"
@@ -177,6 +206,103 @@ extern "C"
 
 //! @}
 
+
+/***************************************************************************************************/
+//! @defgroup ARAAudioFileChunksIndex ARA Audio File Chunks Index (draft)
+//!
+//! When browsing large audio libraries, hosts may want to indicate which files carry ARA audio
+//! file chunks for which plug-ins without opening and parsing each file. For this purpose, hosts
+//! or library vendors can create an index file that summarizes the ARA audio file chunks of all
+//! audio files in a folder hierarchy.
+//! The index is a UTF-8 encoded XML document that reuses the element names defined in
+//! @ref ARAAudioFileChunks for the meta information of each audio source archive, but instead of
+//! the actual archive data it stores the byte range of the Base64 text of the #kARAXMLName_ArchiveData
+//! element inside the audio file, so that importers can directly read the archive from there.
+//! The same encoding restrictions as for the \<ARA\> sub-tree in audio files apply, for example:
+//! \code{.xml}
+//! <audioFileChunksIndex>
+//!     <formatVersion>1</formatVersion>
+//!     <audioFiles>
+//!         <audioFile>
+//!             <filePath>Loops/Guitar/Funky Strum 96bpm.wav</filePath>
+//!             <fileSize>2117680</fileSize>
+//!             <fileModificationDate>2024-05-17T09:41:12Z</fileModificationDate>
+//!             <audioSources>
+//!                 <audioSource>
+//!                     <documentArchiveID>com.celemony.ara.audiosourcedescription.13</documentArchiveID>
+//!                     <openAutomatically>false</openAutomatically>
+//!                     <createDistinctAudioModification>false</createDistinctAudioModification>
+//!                     <suggestedPlugIn>
+//!                         <plugInName>Melodyne</plugInName>
+//!                         <lowestSupportedVersion>5.0.0</lowestSupportedVersion>
+//!                         <manufacturerName>Celemony</manufacturerName>
+//!                         <informationURL>https://www.celemony.com</informationURL>
+//!                     </suggestedPlugIn>
+//!                     <persistentID>59D4874F-FA5A-4FE8-BAC6-0E8BC5F6184A</persistentID>
+//!                     <archiveDataOffset>2101324</archiveDataOffset>
+//!                     <archiveDataLength>16008</archiveDataLength>
+//!                 </audioSource>
+//!             </audioSources>
+//!         </audioFile>
+//!         <!-- ... more audio files here ... -->
+//!     </audioFiles>
+//! </audioFileChunksIndex>
+//! \endcode
+//! Audio files that do not contain any ARA audio file chunks should not be listed.
+//! Before relying on an entry, readers must compare the file size and modification date against
+//! the actual file, and ignore the entry (and preferably update the index) if they do not match.
+//! @{
+
+#if defined(__cplusplus)
+    //! Name of the root XML element of an audio file chunks index.
+    constexpr auto kARAXMLName_AudioFileChunksIndex { "audioFileChunksIndex" };
+    //! Name of the XML element inside the root element that encodes the version of the index format.
+    //! integer value, currently 1. Readers must ignore indices with a version they do not know.
+    constexpr auto kARAXMLName_IndexFormatVersion { "formatVersion" };
+
+    //! Name of the XML element inside the root element that contains the list of indexed audio files.
+    constexpr auto kARAXMLName_AudioFiles { "audioFiles" };
+    //! Name of each XML element inside the list of indexed audio files.
+    //! Contains a list of audio source archives tagged #kARAXMLName_AudioSources with the same
+    //! content as in the audio file, except that #kARAXMLName_ArchiveData is replaced by
+    //! #kARAXMLName_ArchiveDataOffset and #kARAXMLName_ArchiveDataLength.
+    constexpr auto kARAXMLName_AudioFile { "audioFile" };
+
+    //! Name of the XML element inside an audio file element that encodes the path of the file.
+    //! string value, relative to the folder containing the index file, using '/' as separator.
+    constexpr auto kARAXMLName_FilePath { "filePath" };
+    //! Name of the XML element inside an audio file element that encodes the size of the file in bytes.
+    //! integer value, used to detect outdated entries.
+    constexpr auto kARAXMLName_FileSize { "fileSize" };
+    //! Name of the XML element inside an audio file element that encodes the modification date of the file.
+    //! string value in UTC as defined by ISO 8601 (e.g. "2024-05-17T09:41:12Z"), used to detect outdated entries.
+    constexpr auto kARAXMLName_FileModificationDate { "fileModificationDate" };
+
+    //! Name of the XML element inside an indexed audio source archive that encodes the byte offset
+    //! of the Base64 text of the archive data relative to the start of the audio file.
+    //! integer value.
+    constexpr auto kARAXMLName_ArchiveDataOffset { "archiveDataOffset" };
+    //! Name of the XML element inside an indexed audio source archive that encodes the length in
+    //! bytes of the Base64 text of the archive data (including any whitespace) in the audio file.
+    //! integer value.
+    constexpr auto kARAXMLName_ArchiveDataLength { "archiveDataLength" };
+#else
+    #define kARAXMLName_AudioFileChunksIndex "audioFileChunksIndex"
+    #define kARAXMLName_IndexFormatVersion "formatVersion"
+
+    #define kARAXMLName_AudioFiles "audioFiles"
+    #define kARAXMLName_AudioFile "audioFile"
+
+    #define kARAXMLName_FilePath "filePath"
+    #define kARAXMLName_FileSize "fileSize"
+    #define kARAXMLName_FileModificationDate "fileModificationDate"
+
+    #define kARAXMLName_ArchiveDataOffset "archiveDataOffset"
+    #define kARAXMLName_ArchiveDataLength "archiveDataLength"
+#endif
+
+//! @}
+
 #if defined(__cplusplus) && !(ARA_DOXYGEN_BUILD)
 }   // extern "C"
 }   // namespace ARA
@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+//! \file       ARAChunkedArchive.h
+//!             definition of an optional chunked container format for ARA document archives
+//! \project    ARA API Specification
+//! \copyright  Copyright (c) 2025, Celemony Software GmbH, All Rights Reserved.
+//! \license    Licensed under the Apache License, Version 2.0 (the "License");
+//!             you may not use this file except in compliance with the License.
+//!             You may obtain a copy of the License at
+//!
+//!               http://www.apache.org/licenses/LICENSE-2.0
+//!
+//!             Unless required by applicable law or agreed to in writing, software
+//!             distributed under the License is distributed on an "AS IS" BASIS,
+//!             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//!             See the License for the specific language governing permissions and
+//!             limitations under the License.
+//------------------------------------------------------------------------------
+
+
+#ifndef ARAChunkedArchive_h
+#define ARAChunkedArchive_h
+
+#include "ARAInterface.h"
+
+#if defined(__cplusplus) && !(ARA_DOXYGEN_BUILD)
+namespace ARA
+{
+extern "C"
+{
+#endif
+
+/***************************************************************************************************/
+//! @defgroup ARAChunkedArchive ARA Chunked Archives (draft)
+//!
+//! The content of the archives written via ARAArchivingControllerInterface::writeBytesToArchive()
+//! is opaque to the host, and plug-ins are free to choose any encoding. Many plug-ins however face
+//! the same problems when designing their encoding: they need to be able to write large documents
+//! without buffering the entire archive in memory, and when restoring only a subset of the objects
+//! via ARARestoreObjectsFilter they want to access the requested objects without parsing all data
+//! stored before them.
+//! \br
+//! This optional container format addresses these problems in a common way. The archive starts
+//! with a fixed-size header, followed by the chunks that contain the actual (plug-in specific)
+//! data of the archived objects, typically one chunk per audio source or audio modification plus
+//! one for the private document data. After all chunks, a table of contents lists the chunks along
+//! with the persistent IDs of the objects they contain.
+//! \br
+//! When storing, plug-ins encode one object after the other and append its chunk to the archive,
+//! collecting the according table of contents entry. After writing the table of contents, they
+//! "rewind" to update its position in the header, as explicitly allowed by writeBytesToArchive().
+//! This way, memory usage is bounded by the size of the largest object instead of the size of the
+//! entire document.
+//! When restoring, plug-ins read the header and the table of contents first, and then directly
+//! read the chunks of the objects that are requested by the ARARestoreObjectsFilter.
+//! \br
+//! All integer values are stored as unsigned integers in little-endian byte order, regardless of
+//! the byte order of the machine. All positions are byte offsets relative to the start of the
+//! archive. Since the format is byte-oriented, there are no alignment requirements. Any bytes that
+//! are marked as reserved must be written as 0 and must be ignored when reading.
+//! \br
+//! Layout of the archive header:
+//! \code
+//! offset  size    content
+//!  0       8      magic bytes kARAChunkedArchiveMagic (not 0-terminated)
+//!  8       4      format version, see kARAChunkedArchiveFormatVersion
+//! 12       4      reserved
+//! 16       8      position of the table of contents
+//! \endcode
+//! Layout of the table of contents:
+//! \code
+//! offset  size    content
+//!  0       4      number of entries
+//!  4       4      reserved
+//!  8       ...    entries, stored consecutively
+//! \endcode
+//! Layout of each table of contents entry:
+//! \code
+//! offset  size    content
+//!  0       4      entry size in bytes, including this field and the persistent ID
+//!  4       4      chunk type, see ARAArchiveChunkType
+//!  8       8      chunk position
+//! 16       8      chunk size in bytes (as stored, i.e. after compression)
+//! 24       4      size of the persistent ID in bytes
+//! 28       4      codec used to compress the chunk, see ARAArchiveCodec
+//! 32       8      uncompressed chunk size in bytes (equal to the chunk size if not compressed)
+//! ...      ...    persistent ID (seven-bit US-ASCII, not 0-terminated) at the end of the entry
+//! \endcode
+//! Each chunk can be compressed individually, so that chunks can still be accessed directly when
+//! restoring. The uncompressed size allows readers to allocate the target buffer up front.
+//! Future revisions of the format may append further fields to the fixed part of the entries.
+//! Since the persistent ID is always stored at the very end of each entry, its position can be
+//! derived from the entry size and the size of the persistent ID, and readers can skip any fields
+//! they do not know. Such compatible extensions do not change kARAChunkedArchiveFormatVersion.
+//! The format version is only increased for incompatible changes, and readers must reject archives
+//! with a format version larger than the version they implement.
+//! \br
+//! Plug-ins that use this format should indicate this through their ARAFactory::documentArchiveID,
+//! so that they can detect archives created with earlier, non-chunked encodings.
+//! \br
+//! Plug-ins that do not use the chunked format can still use the same codecs for compressing their
+//! entire archive data by prefixing it with a self-describing compressed archive header:
+//! \code
+//! offset  size    content
+//!  0       8      magic bytes kARACompressedArchiveMagic (not 0-terminated)
+//!  8       4      codec used to compress the data, see ARAArchiveCodec
+//! 12       4      reserved
+//! 16       8      uncompressed data size in bytes
+//! 24       ...    compressed data, extending to the end of the archive
+//! \endcode
+//! Since archives are read and written through the byte-oriented ARAArchivingControllerInterface,
+//! the codecs can be implemented as streaming wrappers around readBytesFromArchive() and
+//! writeBytesToArchive(), so that compression does not require buffering the entire archive.
+//! \br
+//! Document archives are loaded and saved frequently, so they should prefer fast codecs such as
+//! LZ4. Audio file chunks are created once but distributed widely, so they should prefer codecs
+//! with better compression ratios such as Zstandard, see @ref ARAAudioFileChunks.
+//! @{
+
+//! Magic bytes at the start of each chunked archive.
+#if defined(__cplusplus)
+    constexpr auto kARAChunkedArchiveMagic { "ARAChnkd" };
+#else
+    #define kARAChunkedArchiveMagic "ARAChnkd"
+#endif
+
+//! Magic bytes at the start of each compressed archive.
+#if defined(__cplusplus)
+    constexpr auto kARACompressedArchiveMagic { "ARACmprs" };
+#else
+    #define kARACompressedArchiveMagic "ARACmprs"
+#endif
+
+//! Format constants for chunked archives.
+enum ARA_DRAFT
+{
+    //! Current version of the chunked archive format.
+    kARAChunkedArchiveFormatVersion = 1,
+
+    //! Size of the magic bytes at the start of the archive.
+    kARAChunkedArchiveMagicSize = 8,
+
+    //! Size of the archive header, the first chunk immediately follows it.
+    kARAChunkedArchiveHeaderSize = 24,
+
+    //! Size of the table of contents header, the first entry immediately follows it.
+    kARAChunkedArchiveTOCHeaderSize = 8,
+
+    //! Minimum size of the fixed part of a table of contents entry, i.e. the minimum size of an
+    //! entry without persistent ID. Entries written by later revisions of the format may have a
+    //! larger fixed part, see above.
+    kARAChunkedArchiveTOCEntryMinSize = 40,
+
+    //! Size of the magic bytes at the start of a compressed archive.
+    kARACompressedArchiveMagicSize = 8,
+
+    //! Size of the compressed archive header, the compressed data immediately follows it.
+    kARACompressedArchiveHeaderSize = 24
+};
+
+//! Types of the chunks stored in a chunked archive.
+ARA_DRAFT typedef ARAInt32 ARAArchiveChunkType;
+enum ARA_DRAFT
+{
+    //! Chunk with the private document data, see ARAStoreObjectsFilter::documentData.
+    //! The persistent ID of the entry is empty.
+    kARAArchiveChunkTypeDocumentData = 1,
+
+    //! Chunk with the state of the audio source with the given persistent ID.
+    kARAArchiveChunkTypeAudioSource = 2,
+
+    //! Chunk with the state of the audio modification with the given persistent ID.
+    kARAArchiveChunkTypeAudioModification = 3,
+
+    //! Plug-ins may define private chunk types for any other data, using values starting here.
+    //! Readers must skip chunk types they do not know.
+    kARAArchiveChunkTypeFirstPrivate = 0x10000
+};
+
+//! Codecs for compressing archive data.
+//! Each codec stores its data in its own self-contained frame format as referenced below, so that
+//! its standard implementation can decode it without further information.
+ARA_DRAFT typedef ARAInt32 ARAArchiveCodec;
+enum ARA_DRAFT
+{
+    //! Data is stored uncompressed.
+    kARAArchiveCodecNone = 0,
+
+    //! LZ4 frame format, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md.
+    kARAArchiveCodecLZ4 = 1,
+
+    //! Zstandard frame format, see https://tools.ietf.org/html/rfc8878.
+    kARAArchiveCodecZstandard = 2,
+
+    //! zlib format, see https://tools.ietf.org/html/rfc1950.
+    kARAArchiveCodecZlib = 3,
+
+    //! Plug-ins may define private codecs, using values starting here.
+    //! Since such data cannot be decoded by other implementations, it should be avoided in
+    //! audio file chunks.
+    kARAArchiveCodecFirstPrivate = 0x10000
+};
+
+//! @}
+
+#if defined(__cplusplus) && !(ARA_DOXYGEN_BUILD)
+}   // extern "C"
+}   // namespace ARA
+#endif
+
+#endif // ARAChunkedArchive_h
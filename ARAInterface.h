@@ -368,6 +368,29 @@ ARA_ADDENDUM(2_0_Final) typedef ARA_32_BIT_ENUM(ARAChannelArrangementDataType)
     kARAChannelArrangementCLAPAmbisonicInfo = 5
 };
 
+//! Encoding of individual samples when exchanging sample data in formats other than the
+//! 32 or 64 bit float samples provided by ARAAudioAccessControllerInterface::readAudioSamples().
+//! Integer formats are signed, and their full scale maps to the float range of -1.0 to 1.0,
+//! e.g. for 16 bit samples 32768 equals 1.0.
+ARA_DRAFT typedef ARA_32_BIT_ENUM(ARASampleFormat)
+{
+    //! Used to indicate the format is unknown or not applicable.
+    kARASampleFormatUndefined = 0,
+    //! 16 bit signed integer.
+    kARASampleFormatInt16 = 1,
+    //! 24 bit signed integer, packed into 3 bytes.
+    kARASampleFormatInt24 = 2,
+    //! 32 bit signed integer.
+    kARASampleFormatInt32 = 3,
+    //! 32 bit IEEE 754 floating point.
+    kARASampleFormatFloat32 = 4,
+    //! 64 bit IEEE 754 floating point.
+    kARASampleFormatFloat64 = 5,
+    //! 24 bit signed integer, stored sign-extended in a 32 bit integer
+    //! (i.e. full scale is 8388608, not 2147483648 as for kARASampleFormatInt32).
+    kARASampleFormatInt24In32 = 6
+};
+
 //! @}
 
 /***************************************************************************************************/
@@ -432,6 +455,7 @@ ARA_ADDENDUM(2_0_Draft) typedef struct ARAColor
 //! ::ARAContentReaderHostRef           \br
 //! ::ARAAudioAccessControllerHostRef   \br
 //! ::ARAAudioReaderHostRef             \br
+//! ::ARAAudioReadRequestHostRef        \br
 //! ::ARAArchivingControllerHostRef     \br
 //! ::ARAArchiveReaderHostRef           \br
 //! ::ARAArchiveWriterHostRef           \br
@@ -886,6 +910,30 @@ typedef struct ARAAudioSourceProperties
     //! To determine which channel arrangements are supported by the plug-in, the host will use the
     //! companion API and read the valid render input formats.
     ARA_ADDENDUM(2_0_Final) const void * channelArrangement;
+
+    //! Encoding of the samples as stored by the host, e.g. in the underlying audio file.
+    //! Plug-ins can use this information to pick the most appropriate format when creating audio
+    //! readers via ARAAudioAccessControllerInterface::createAudioReaderForSourceWithFormat(), or
+    //! when choosing the format of their internal sample caches.
+    //! Should be kARASampleFormatUndefined if the host does not know the format, or if the data is
+    //! stored in a compressed format that does not map to any ARASampleFormat.
+    //! May only be changed while access to the audio source is disabled,
+    //! see ARADocumentControllerInterface::enableAudioSourceSamplesAccess().
+    ARA_DRAFT ARASampleFormat nativeSampleFormat;
+
+    //! Optional fingerprint of the audio content of the audio source, or NULL if not provided.
+    //! Unlike the #persistentID, the fingerprint depends only on the actual sample data, so that
+    //! audio sources using the same audio (e.g. the same loop imported into different documents)
+    //! share the same fingerprint. It allows plug-ins to look up previous analysis results via
+    //! ARAArchivingControllerInterface::createCachedAnalysisArchiveReader().
+    //! The fingerprint should start with an identifier of the algorithm used to calculate it,
+    //! e.g. "sha256:" followed by the lowercase hex digest of the sample data, so that fingerprints
+    //! calculated with different algorithms never collide.
+    //! If the host does not provide a fingerprint, plug-ins may calculate their own one using an
+    //! audio reader once sample access is enabled.
+    //! May only be changed while access to the audio source is disabled,
+    //! see ARADocumentControllerInterface::enableAudioSourceSamplesAccess().
+    ARA_DRAFT ARAPersistentID contentFingerprint;
 } ARAAudioSourceProperties;
 
 // Convenience constant for easy struct validation.
@@ -1291,6 +1339,11 @@ typedef ARA_32_BIT_ENUM(ARAContentGrade)
     kARAContentGradeApproved = 3
 };
 
+
+//! Content revision: counter to validate cached copies of content information.
+//! See ARADocumentControllerInterface::getAudioSourceContentRevision() for details.
+ARA_DRAFT typedef ARAInt64 ARAContentRevision;
+
 //! @}
 
 
@@ -1768,6 +1821,129 @@ typedef ARA_HOST_REF(ARAAudioAccessControllerHostRef);
 //! Reference to the host side representation of an audio reader (opaque to the plug-in).
 typedef ARA_HOST_REF(ARAAudioReaderHostRef);
 
+//! Reference to the host side representation of a pending asynchronous read (opaque to the plug-in).
+ARA_DRAFT typedef ARA_HOST_REF(ARAAudioReadRequestHostRef);
+
+//! State of an asynchronous read, see ARAAudioAccessControllerInterface::waitForAudioSamplesRead().
+ARA_DRAFT typedef ARA_32_BIT_ENUM(ARAAudioReadRequestState)
+{
+    //! The read has not yet been concluded, the target buffers are still in use by the host.
+    kARAAudioReadRequestPending = 0,
+
+    //! The read concluded successfully, the target buffers contain the requested samples.
+    kARAAudioReadRequestSucceeded = 1,
+
+    //! The read concluded with a critical, nonrecoverable I/O error. As with readAudioSamples(),
+    //! the target buffers have been filled with silence and the host will notify the user.
+    kARAAudioReadRequestFailed = 2,
+
+    //! The read was cancelled via ARAAudioAccessControllerInterface::cancelAudioSamplesRead()
+    //! before it was concluded. The contents of the target buffers are undefined.
+    kARAAudioReadRequestCancelled = 3
+};
+
+//! Description of a single range to read via ARAAudioAccessControllerInterface::readAudioSamplesForRanges().
+//! The members correspond to the respective arguments of ARAAudioAccessControllerInterface::readAudioSamples().
+ARA_DRAFT typedef struct ARAAudioSamplesRange
+{
+    //! Start of the range, may extend beyond the start or end of the audio source like in readAudioSamples().
+    ARASamplePosition samplePosition;
+
+    //! Length of the range.
+    ARASampleCount samplesPerChannel;
+
+    //! Target buffer(s) for the range, provided by the caller.
+    void * const * buffers;
+} ARAAudioSamplesRange;
+
+//! Read-only view of the native sample data of an audio source,
+//! see ARAAudioAccessControllerInterface::acquireAudioSourceSamplesView().
+//! The view covers all samples of the audio source as described by ARAAudioSourceProperties::sampleCount
+//! and ARAAudioSourceProperties::channelCount. Sample i of channel c is located at the address
+//! (const ARAByte *)channelData[c] + i * sampleStride.
+//! This allows to describe both interleaved and non-interleaved data.
+//! Like the buffers filled by ARAAudioAccessControllerInterface::readAudioSamples(), the samples
+//! must be aligned to the machine's native alignment of their type, so that plug-ins can access
+//! them directly. For kARASampleFormatInt16, kARASampleFormatInt32, kARASampleFormatInt24In32,
+//! kARASampleFormatFloat32 and kARASampleFormatFloat64, each #channelData pointer and the
+//! #sampleStride must therefore be a multiple of the size of a sample - only kARASampleFormatInt24
+//! samples may be located at any byte address.
+ARA_DRAFT typedef struct ARAAudioSourceSamplesView
+{
+    //! @see_Versioned_Structs
+    ARASize structSize;
+
+    //! Encoding of the individual samples.
+    //! As with all ARA sample data, byte order always matches the machine's native layout - hosts
+    //! must not provide views for data that would need byte swapping (such as plain AIFF on little
+    //! endian machines).
+    ARASampleFormat sampleFormat;
+
+    //! Distance in bytes from one sample of a given channel to the next sample of the same channel.
+    //! For non-interleaved data this equals the size of a sample, for interleaved data it equals
+    //! the size of a sample multiplied by the channel count.
+    ARASize sampleStride;
+
+    //! Variable-sized C array with one pointer per channel, each pointing to the first sample of
+    //! the respective channel.
+    const void * const * channelData;
+} ARAAudioSourceSamplesView;
+
+// Convenience constant for easy struct validation.
+enum ARA_DRAFT { kARAAudioSourceSamplesViewMinSize = ARA_IMPLEMENTED_STRUCT_SIZE(ARAAudioSourceSamplesView, channelData) };
+
+//! Sample data format for audio readers, see ARAAudioAccessControllerInterface::createAudioReaderForSourceWithFormat().
+//! Note that a pointer to this struct is only valid for the duration of the call receiving the
+//! pointer - the data must be evaluated/copied inside the call, and the pointer must not be stored anywhere.
+ARA_DRAFT typedef struct ARAAudioReaderFormat
+{
+    //! @see_Versioned_Structs
+    ARASize structSize;
+
+    //! Encoding of the individual samples.
+    ARASampleFormat sampleFormat;
+
+    //! Layout of the channels in the buffers provided when reading.
+    //! If kARAFalse, each channel is read into a separate buffer (as is the case for audio readers
+    //! created with createAudioReaderForSource()). If kARATrue, all channels are read interleaved
+    //! into a single buffer, which then contains channelCount * samplesPerChannel samples.
+    ARABool interleaved;
+} ARAAudioReaderFormat;
+
+// Convenience constant for easy struct validation.
+enum ARA_DRAFT { kARAAudioReaderFormatMinSize = ARA_IMPLEMENTED_STRUCT_SIZE(ARAAudioReaderFormat, interleaved) };
+
+//! Hint about the expected order of reads, see ARAAudioAccessControllerInterface::setAudioReaderAccessPattern().
+ARA_DRAFT typedef ARA_32_BIT_ENUM(ARAAudioReaderAccessPattern)
+{
+    //! No particular order can be predicted, this is the implicit default for all audio readers.
+    //! As described above, this is the typical pattern when rendering.
+    kARAAudioReaderAccessPatternUnspecified = 0,
+
+    //! The source will be read consecutively from front to back, as is typical during analysis.
+    //! Hosts can read ahead aggressively and release data that has already been read.
+    kARAAudioReaderAccessPatternSequentialForward = 1,
+
+    //! The reads will be scattered randomly across the source.
+    //! Hosts should not read ahead beyond the requested data.
+    kARAAudioReaderAccessPatternRandom = 2
+};
+
+//! Envelope of a block of consecutive samples of a single channel,
+//! see ARAAudioAccessControllerInterface::readAudioOverview().
+//! Values are normalized to the range of float samples, independently of the format of the reader.
+ARA_DRAFT typedef struct ARAAudioOverviewBlock
+{
+    //! Smallest sample value in the block.
+    float minimum;
+
+    //! Largest sample value in the block.
+    float maximum;
+
+    //! Root mean square of the sample values in the block.
+    float rms;
+} ARAAudioOverviewBlock;
+
 //! Host interface: audio access controller.
 //! As with all host interfaces, the function pointers in this struct must remain valid until
 //! all document controllers on the plug-in side that use it have been destroyed.
@@ -1792,7 +1968,8 @@ typedef struct ARAAudioAccessControllerInterface
 
     //! Read audio samples.
     //! The samples are provided in non-interleaved buffers of double or float data, depending on
-    //! whether use64BitSamples was set when creating the reader. The channel count equals the
+    //! whether use64BitSamples was set when creating the reader (unless a different format was
+    //! configured via createAudioReaderForSourceWithFormat(), see there). The channel count equals the
     //! channel count of the audio source. The data alignment and byte order always matches the
     //! machine's native layout.
     //! If the requested sample range extends beyond the start or end of the audio source, the
@@ -1815,6 +1992,152 @@ typedef struct ARAAudioAccessControllerInterface
     //! See ARAAudioAccessControllerInterface::createAudioReaderForSource() about the restrictions when to call this.
     void (ARA_CALL *destroyAudioReader) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef);
 //@}
+
+//! @name Asynchronous reading: queueing reads without blocking until data is available
+//! These optional calls allow plug-ins to keep several reads in flight for a given audio reader,
+//! so that I/O latency can be overlapped with processing previously read data, and so that the
+//! host can schedule its I/O across all pending requests.
+//! The same threading rules as for readAudioSamples() apply: the calls for a given reader may be
+//! made from any non-realtime thread, but not from more than one thread at the same time.
+//! Synchronous and asynchronous reads may be mixed on the same reader.
+//! Each submitted read must eventually be concluded by receiving a final state (i.e. any state
+//! other than kARAAudioReadRequestPending) from waitForAudioSamplesRead() - this is required even
+//! if the read has been cancelled. Receiving the final state releases the request, its host ref
+//! must no longer be used afterwards.
+//! Before destroying the reader or acknowledging disabling the access to its audio source via
+//! ARADocumentControllerInterface::enableAudioSourceSamplesAccess(), plug-ins must conclude all
+//! pending reads (typically by cancelling them and then waiting for their final state).
+//! Hosts must either implement all of these calls or none of them.
+//@{
+    //! Queue reading audio samples without waiting for the data to be available.
+    //! The parameters and the format of the data are the same as for readAudioSamples(), but unlike
+    //! readAudioSamples() the buffers (and the array of buffer pointers) are owned by the host until
+    //! the read has been concluded, the plug-in must neither access nor free them before that.
+    //! The host may conclude the reads in any order.
+    //! The returned ref must not be NULL - if the host is unable to queue the read for some reason,
+    //! it must synchronously execute it and report its final state upon the first wait call.
+    ARA_DRAFT ARAAudioReadRequestHostRef (ARA_CALL *submitAudioSamplesRead) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef,
+                                                                             ARASamplePosition samplePosition, ARASampleCount samplesPerChannel, void * const buffers[]);
+
+    //! Query or wait for the state of the given read.
+    //! If the read is still pending, the host will block for at most the given timeout until the read
+    //! is concluded. A timeout of 0.0 can be used to poll the state without blocking, a negative
+    //! timeout waits until the read is concluded.
+    //! As with readAudioSamples(), the plug-in must be designed to deal with the blocking without
+    //! triggering priority inversion.
+    ARA_DRAFT ARAAudioReadRequestState (ARA_CALL *waitForAudioSamplesRead) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef,
+                                                                            ARAAudioReadRequestHostRef readRequestHostRef, ARATimeDuration timeout);
+
+    //! Request to cancel the given read.
+    //! This call does not block, and the host may still conclude the read with any final state,
+    //! e.g. if the data was already being transferred into the buffers.
+    //! The plug-in must still call waitForAudioSamplesRead() until the final state is received
+    //! before re-using the target buffers.
+    ARA_DRAFT void (ARA_CALL *cancelAudioSamplesRead) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef,
+                                                       ARAAudioReadRequestHostRef readRequestHostRef);
+//@}
+
+//! @name Vectored reading: gathering multiple ranges in a single call
+//@{
+    //! Read audio samples for multiple, potentially scattered ranges of the audio source.
+    //! This optional call is equivalent to calling readAudioSamples() for each of the ranges, but
+    //! allows the host to merge and reorder the underlying I/O and to save the per-call overhead
+    //! when the plug-in reads many small sections of the source, e.g. when evaluating transients.
+    //! The ranges may be given in any order and may overlap, but their target buffers must not overlap.
+    //! The rangesCount must not be 0, and the ranges pointer is only valid for the duration of the call.
+    //! Threading and blocking behavior is the same as for readAudioSamples().
+    //! Result is kARATrue if all ranges were read successfully. Upon any critical, nonrecoverable
+    //! I/O error the result is kARAFalse, and the buffers of all ranges that could not be read must be
+    //! filled with silence. Error handling on both sides is the same as for readAudioSamples().
+    ARA_DRAFT ARABool (ARA_CALL *readAudioSamplesForRanges) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef,
+                                                             ARASize rangesCount, const ARAAudioSamplesRange ranges[]);
+//@}
+
+//! @name Direct access: read-only views of the native sample data
+//! If the host already holds the sample data of an audio source in memory in an uncompressed format,
+//! e.g. because it maps a PCM WAVE file into its address space, it can optionally expose this data
+//! directly to the plug-in. This avoids copying and converting the samples when reading them
+//! through an audio reader, reducing memory bandwidth and overall memory usage during analysis.
+//! Plug-ins must always be prepared to fall back to audio readers if no view is available.
+//! Hosts must either implement both of these calls or none of them.
+//@{
+    //! Lease a read-only view of the native sample data of the given audio source.
+    //! Result is NULL if the host cannot provide such a view for the audio source, e.g. because the
+    //! data is compressed or stored remotely, or because the data does not meet the alignment
+    //! requirements described for ARAAudioSourceSamplesView (which can easily happen for memory-mapped
+    //! files, since e.g. the data chunk in WAVE files only needs to start at an even file offset).
+    //! The same restrictions as for createAudioReaderForSource() apply regarding when to call this.
+    //! The returned struct and the sample data it describes are owned by the host, and must remain
+    //! valid and unchanged until the plug-in releases the view. Accordingly, before acknowledging
+    //! disabling the access to the audio source via ARADocumentControllerInterface::enableAudioSourceSamplesAccess(),
+    //! plug-ins must release all views of the audio source.
+    //! The sample data may be accessed concurrently from any non-realtime thread. Note that accessing
+    //! the data may block the calling thread, e.g. while the operating system is loading a memory-mapped
+    //! file page, so the same considerations apply as for readAudioSamples().
+    ARA_DRAFT const ARAAudioSourceSamplesView * (ARA_CALL *acquireAudioSourceSamplesView) (ARAAudioAccessControllerHostRef controllerHostRef,
+                                                                                          ARAAudioSourceHostRef audioSourceHostRef);
+
+    //! Release a view previously acquired for the given audio source.
+    //! The caller must guarantee that the view data is currently not in use in some other thread.
+    //! The same restrictions as for destroyAudioReader() apply regarding when to call this.
+    ARA_DRAFT void (ARA_CALL *releaseAudioSourceSamplesView) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioSourceHostRef audioSourceHostRef,
+                                                              const ARAAudioSourceSamplesView * samplesView);
+//@}
+
+//! @name Reading in other sample formats
+//@{
+    //! Create an audio reader instance that provides the samples in the given format and layout.
+    //! This optional call allows plug-ins that internally store samples in a compact integer format
+    //! to directly read that format, so that the samples are converted at most once (or not at all
+    //! if the requested format matches ARAAudioSourceProperties::nativeSampleFormat).
+    //! Result is NULL if the host does not support the requested format, in which case the plug-in
+    //! can fall back to a different format or to createAudioReaderForSource().
+    //! Hosts implementing this call must support non-interleaved kARASampleFormatFloat32 and
+    //! kARASampleFormatFloat64, which are equivalent to calling createAudioReaderForSource().
+    //! When converting from a format with higher resolution, the host should apply proper rounding
+    //! and clipping, dithering is not necessary.
+    //! Once created, the reader behaves like any other reader, only its buffers are formatted as
+    //! requested for all read calls. The same restrictions apply regarding when to call this as
+    //! for createAudioReaderForSource(), and readers created here are destroyed with destroyAudioReader().
+    ARA_DRAFT ARAAudioReaderHostRef (ARA_CALL *createAudioReaderForSourceWithFormat) (ARAAudioAccessControllerHostRef controllerHostRef,
+                                                                                      ARAAudioSourceHostRef audioSourceHostRef, const ARAAudioReaderFormat * format);
+//@}
+
+//! @name Access hints: enabling the host to optimize its I/O
+//! These optional calls are hints only, hosts are free to ignore them and plug-ins must not rely on
+//! any particular effect. They must not block, and the same threading rules as for readAudioSamples()
+//! apply. Hosts must either implement both of these calls or none of them.
+//@{
+    //! Inform the host about the order in which the plug-in is going to read from the given reader.
+    //! The pattern remains in effect until it is changed by another call or the reader is destroyed.
+    ARA_DRAFT void (ARA_CALL *setAudioReaderAccessPattern) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef,
+                                                            ARAAudioReaderAccessPattern accessPattern);
+
+    //! Inform the host that the given range will be read soon via the given reader, so that the
+    //! host can start loading it in the background.
+    //! Issuing a new prefetch does not cancel previous prefetches that are still pending.
+    ARA_DRAFT void (ARA_CALL *prefetchAudioSamples) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef,
+                                                     ARASamplePosition samplePosition, ARASampleCount samplesPerChannel);
+//@}
+
+//! @name Overview reading: decimated envelope of the audio source
+//@{
+    //! Read a decimated envelope of the audio source, e.g. for drawing waveforms or for quick
+    //! loudness estimations that do not require the full sample data.
+    //! This optional call allows hosts that maintain peak files to provide such data without
+    //! decoding the audio file. Hosts implementing this call must support any samplesPerBlock
+    //! larger than 0, even if this requires calculating the blocks from the sample data.
+    //! Plug-ins should therefore prefer powers of two of 256 or more for samplesPerBlock, which
+    //! are commonly used as resolution of peak files.
+    //! The blocks are provided in one array per channel, each containing blocksCount entries.
+    //! The first block starts at samplePosition, each block covers samplesPerBlock samples.
+    //! Like in readAudioSamples(), samples outside of the audio source are considered silent.
+    //! Threading, blocking behavior and error handling are the same as for readAudioSamples(),
+    //! the block arrays must be filled with 0.0f values in case of failure.
+    ARA_DRAFT ARABool (ARA_CALL *readAudioOverview) (ARAAudioAccessControllerHostRef controllerHostRef, ARAAudioReaderHostRef audioReaderHostRef,
+                                                     ARASamplePosition samplePosition, ARASampleCount samplesPerBlock,
+                                                     ARASize blocksCount, ARAAudioOverviewBlock * const blocks[]);
+//@}
 } ARAAudioAccessControllerInterface;
 
 // Convenience constant for easy struct validation.
@@ -1944,6 +2267,101 @@ typedef struct ARAArchivingControllerInterface
     //! All hosts that support kARAAPIGeneration_2_0_Final or newer must implement this call.
     ARA_ADDENDUM(2_0_Final) ARAPersistentID (ARA_CALL *getDocumentArchiveID) (ARAArchivingControllerHostRef controllerHostRef, ARAArchiveReaderHostRef archiveReaderHostRef);
 //@}
+
+//! @name Analysis Result Cache
+//! Hosts may provide a persistent cache for analysis results that is shared across documents,
+//! so that plug-ins do not need to analyze the same audio again each time it is used in a new
+//! document. Cache entries are keyed by the content fingerprint of the audio source (see
+//! ARAAudioSourceProperties::contentFingerprint) and the document archive ID of the plug-in that
+//! wrote them, and contain analysis data in a plug-in specific encoding which is opaque to the host.
+//! Hosts will typically implement the cache as content-addressed files on disk, and are free to
+//! evict entries at any time.
+//! The archive readers and writers provided by these calls are accessed with the regular functions
+//! above, but contrary to the restrictions described there, this can be done at any time on the
+//! ARA model thread until they are destroyed. All calls in this section must also be made on the
+//! ARA model thread, but may be made from any ARADocumentControllerInterface call.
+//! Hosts must either implement all of these calls or none of them.
+//@{
+    //! Create an archive reader for the cache entry matching the given fingerprint and document
+    //! archive ID, or return NULL if no such entry exists.
+    //! The document archive ID should be either the plug-in's ARAFactory::documentArchiveID or one
+    //! of its ARAFactory::compatibleDocumentArchiveIDs.
+    ARA_DRAFT ARAArchiveReaderHostRef (ARA_CALL *createCachedAnalysisArchiveReader) (ARAArchivingControllerHostRef controllerHostRef,
+                                                                                     ARAPersistentID contentFingerprint, ARAPersistentID documentArchiveID);
+
+    //! Destroy an archive reader created via createCachedAnalysisArchiveReader().
+    ARA_DRAFT void (ARA_CALL *destroyCachedAnalysisArchiveReader) (ARAArchivingControllerHostRef controllerHostRef, ARAArchiveReaderHostRef archiveReaderHostRef);
+
+    //! Create an archive writer for storing a new cache entry for the given fingerprint and document
+    //! archive ID, typically called when an analysis has been completed. The document archive ID
+    //! must be the plug-in's ARAFactory::documentArchiveID.
+    //! The host may return NULL if it chooses not to cache the data, e.g. due to disk space limits.
+    ARA_DRAFT ARAArchiveWriterHostRef (ARA_CALL *createCachedAnalysisArchiveWriter) (ARAArchivingControllerHostRef controllerHostRef,
+                                                                                     ARAPersistentID contentFingerprint, ARAPersistentID documentArchiveID);
+
+    //! Destroy an archive writer created via createCachedAnalysisArchiveWriter().
+    //! If commit is kARATrue, the written data replaces any existing entry for the same key,
+    //! otherwise (e.g. because the plug-in encountered a write error) it is discarded.
+    //! Hosts must make sure that partially written entries never become visible to readers.
+    ARA_DRAFT void (ARA_CALL *destroyCachedAnalysisArchiveWriter) (ARAArchivingControllerHostRef controllerHostRef, ARAArchiveWriterHostRef archiveWriterHostRef,
+                                                                   ARABool commit);
+//@}
+
+//! @name Concurrent Archive Writing
+//! Since archive writers are sequential byte streams, plug-ins can only encode one object after
+//! the other when storing large documents. These optional calls allow plug-ins to request
+//! independent segment writers, so that they can encode objects concurrently on worker threads.
+//! Each segment writer provides a separate, initially empty byte stream which is written using
+//! writeBytesToArchive() with positions relative to the start of the segment. When done, the
+//! plug-in commits the segment to a given position inside the main archive, where the host stitches
+//! it into the final archive data (which may be implemented without copying, e.g. by writing each
+//! segment to a separate temporary file that is concatenated later).
+//! Plug-ins will typically first write all segments concurrently, then commit them sequentially
+//! at the positions determined by their respective sizes, and finally write any directory data
+//! such as a table of contents to the main archive (see e.g. @ref ARAChunkedArchive).
+//! All calls in this section may only be made from storeObjectsToArchive(), on the ARA model thread.
+//! Contrary to the restrictions described above, writeBytesToArchive() may be called for segment
+//! writers concurrently from any thread while the segment writer exists, as long as each segment
+//! writer is only used by one thread at a time. Progress must still only be notified on the model thread.
+//! Hosts must either implement all of these calls or none of them.
+//@{
+    //! Create a new segment writer for the given archive writer.
+    //! The host may return NULL if it can not provide additional segments, e.g. because it limits
+    //! the number of concurrent segments - in that case, plug-ins must write the data sequentially.
+    ARA_DRAFT ARAArchiveWriterHostRef (ARA_CALL *createArchiveSegmentWriter) (ARAArchivingControllerHostRef controllerHostRef, ARAArchiveWriterHostRef archiveWriterHostRef);
+
+    //! Insert the data written to the given segment writer into the main archive at the given
+    //! position, as if it had been written using writeBytesToArchive() on the main archive writer.
+    //! The plug-in must make sure that no thread is writing to the segment writer anymore when
+    //! making this call, and must not write to it afterwards.
+    //! Result is kARATrue upon success, or kARAFalse when there is a critical, nonrecoverable I/O
+    //! error, with the same implications as when writeBytesToArchive() fails.
+    ARA_DRAFT ARABool (ARA_CALL *commitArchiveSegmentWriter) (ARAArchivingControllerHostRef controllerHostRef, ARAArchiveWriterHostRef archiveWriterHostRef,
+                                                              ARAArchiveWriterHostRef segmentWriterHostRef, ARASize position);
+
+    //! Destroy the given segment writer, discarding its data unless it has been committed.
+    //! Plug-ins must destroy all segment writers they created before returning from storeObjectsToArchive().
+    ARA_DRAFT void (ARA_CALL *destroyArchiveSegmentWriter) (ARAArchivingControllerHostRef controllerHostRef, ARAArchiveWriterHostRef segmentWriterHostRef);
+//@}
+
+//! @name Direct Archive Access
+//! Plug-ins that need to access an archive at many different positions when restoring (e.g. when
+//! using @ref ARAChunkedArchive) pay for a function call and a copy for each readBytesFromArchive().
+//! This optional call allows hosts that have the entire archive available in memory (or can map it
+//! into memory, e.g. from a file) to expose it directly, so that plug-ins can parse it in place.
+//@{
+    //! Query a pointer to the entire archive data as a contiguous, read-only block of memory of the
+    //! size returned by getArchiveSize(), or NULL if the host cannot provide such access for the
+    //! given archive reader. In the latter case, plug-ins must fall back to readBytesFromArchive().
+    //! The same call restrictions as for readBytesFromArchive() apply, and the host must not return
+    //! NULL for the same archive reader if it has previously returned a valid pointer.
+    //! The returned memory is owned by the host and must remain valid and unchanged until the archive
+    //! reader is destroyed (or the call that provided it returns), plug-ins must not write to it.
+    //! Note that if the host maps the memory from a file, accessing it may fail with system-specific
+    //! errors (such as SIGBUS) if the file becomes unavailable, so hosts should only provide mappings
+    //! for files on local storage and otherwise return NULL.
+    ARA_DRAFT const ARAByte * (ARA_CALL *getArchiveBytes) (ARAArchivingControllerHostRef controllerHostRef, ARAArchiveReaderHostRef archiveReaderHostRef);
+//@}
 } ARAArchivingControllerInterface;
 
 // Convenience constant for easy struct validation.
@@ -2025,6 +2443,49 @@ typedef struct ARAContentAccessControllerInterface
     //! Destroy the given content reader.
     void (ARA_CALL *destroyContentReader) (ARAContentAccessControllerHostRef controllerHostRef, ARAContentReaderHostRef contentReaderHostRef);
 //@}
+
+//! @name Bulk Content Reading
+//! These functions mirror the bulk content reading section in ARADocumentControllerInterface.
+//@{
+    //! Copy the data of a consecutive range of events of the given reader into a caller-provided buffer.
+    //! This optional call is equivalent to calling getContentReaderDataForEvent() for each event in
+    //! the range and copying the returned data, but avoids the per-event call overhead.
+    //! The range [firstEventIndex, firstEventIndex + eventsCount) must be a subrange of the events
+    //! exposed by the reader, and eventsCount must not be 0.
+    //! The buffer must be large enough to hold eventsCount structs of the event class associated
+    //! with the content type of the reader (e.g. ARAContentNote for kARAContentTypeNotes), which
+    //! are stored as a C array, i.e. consecutively with a stride of the size of that struct.
+    //! Any pointers contained in the copied events (such as ARAContentChord::name) are owned by the
+    //! host and must remain valid until the content reader is destroyed.
+    ARA_DRAFT void (ARA_CALL *copyContentReaderDataForEvents) (ARAContentAccessControllerHostRef controllerHostRef, ARAContentReaderHostRef contentReaderHostRef,
+                                                               ARAInt32 firstEventIndex, ARAInt32 eventsCount, void * eventsData);
+//@}
+
+//! @name Content Reader Seeking
+//! These functions mirror the content reader seeking section in ARADocumentControllerInterface.
+//@{
+    //! Find the index of the first event of the given reader that is located at or after the given time.
+    //! Implementations can rely on the sort order of the content type and use a binary search.
+    //! This optional call allows for quickly locating events e.g. around the playback position
+    //! without creating a new reader restricted to a time range or repeatedly reading events.
+    //! It may only be used for content types which are sorted by time in seconds:
+    //! kARAContentTypeNotes (by ARAContentNote::startPosition) and kARAContentTypeTempoEntries
+    //! (by ARAContentTempoEntry::timePosition).
+    //! If all events are located before the given position, the event count of the reader is returned.
+    ARA_DRAFT ARAInt32 (ARA_CALL *getContentReaderEventIndexForTime) (ARAContentAccessControllerHostRef controllerHostRef, ARAContentReaderHostRef contentReaderHostRef,
+                                                                      ARATimePosition timePosition);
+
+    //! Find the index of the first event of the given reader that is located at or after the given
+    //! musical position.
+    //! This is the equivalent of getContentReaderEventIndexForTime() for content types which are
+    //! sorted by quarter notes:
+    //! kARAContentTypeTempoEntries (by ARAContentTempoEntry::quarterPosition),
+    //! kARAContentTypeBarSignatures, kARAContentTypeKeySignatures and kARAContentTypeSheetChords
+    //! (by their respective position).
+    //! If all events are located before the given position, the event count of the reader is returned.
+    ARA_DRAFT ARAInt32 (ARA_CALL *getContentReaderEventIndexForQuarter) (ARAContentAccessControllerHostRef controllerHostRef, ARAContentReaderHostRef contentReaderHostRef,
+                                                                         ARAQuarterPosition quarterPosition);
+//@}
 } ARAContentAccessControllerInterface;
 
 // Convenience constant for easy struct validation.
@@ -2054,11 +2515,79 @@ typedef ARA_32_BIT_ENUM(ARAAnalysisProgressState)
     //! State for normal progress of an analysis.
     kARAAnalysisProgressUpdated = 1,
 
-    //! Required as last state for any given analysis (no matter whether it completed or was cancelled).
-    kARAAnalysisProgressCompleted = 2
+    //! Required as last state for any given analysis (no matter whether it completed or was cancelled),
+    //! unless the analysis was cancelled explicitly by the host, see kARAAnalysisProgressCancelled.
+    kARAAnalysisProgressCompleted = 2,
+
+    //! Last state for an analysis that was stopped because the host explicitly cancelled it via
+    //! ARADocumentControllerInterface::cancelAudioSourceContentAnalysis().
+    //! Plug-ins must not use this state in any other situation, so that hosts that do not use
+    //! explicit cancellation will never receive it.
+    ARA_ADDENDUM(2_X_Draft) kARAAnalysisProgressCancelled = 3
 };
 
 
+//! @name Batched model update notifications
+//! Types used by ARAModelUpdateControllerInterface::notifyModelUpdateBatch().
+//@{
+
+//! Kinds of model update notifications, each mapping to the according individual notification call.
+ARA_DRAFT typedef ARA_32_BIT_ENUM(ARAModelUpdateKind)
+{
+    //! Equivalent to ARAModelUpdateControllerInterface::notifyAudioSourceAnalysisProgress().
+    kARAModelUpdateAudioSourceAnalysisProgress = 0,
+
+    //! Equivalent to ARAModelUpdateControllerInterface::notifyAudioSourceContentChanged(),
+    //! or to notifyAudioSourceContentRangesChanged() if multiple ranges are provided.
+    kARAModelUpdateAudioSourceContentChanged = 1,
+
+    //! Equivalent to ARAModelUpdateControllerInterface::notifyAudioModificationContentChanged(),
+    //! or to notifyAudioModificationContentRangesChanged() if multiple ranges are provided.
+    kARAModelUpdateAudioModificationContentChanged = 2,
+
+    //! Equivalent to ARAModelUpdateControllerInterface::notifyPlaybackRegionContentChanged(),
+    //! or to notifyPlaybackRegionContentRangesChanged() if multiple ranges are provided.
+    kARAModelUpdatePlaybackRegionContentChanged = 3,
+
+    //! Equivalent to ARAModelUpdateControllerInterface::notifyDocumentDataChanged().
+    kARAModelUpdateDocumentDataChanged = 4
+};
+
+//! Single model update notification record inside a batch.
+//! Since this struct is used in arrays, it is not versioned - future extensions will be done by
+//! adding new update kinds, which can be introduced without breaking the memory layout.
+ARA_DRAFT typedef struct ARAModelUpdate
+{
+    //! Kind of the update.
+    ARAModelUpdateKind kind;
+
+    //! Host ref of the object the update refers to, with a type matching the update kind (e.g.
+    //! ARAAudioSourceHostRef for kARAModelUpdateAudioSourceContentChanged).
+    //! NULL for kARAModelUpdateDocumentDataChanged.
+    const void * objectHostRef;
+
+    //! Number of affected time ranges for content change updates, 0 if the entire object is affected.
+    //! Always 0 for other update kinds.
+    ARASize rangesCount;
+
+    //! Affected time ranges for content change updates, NULL if #rangesCount is 0.
+    //! If multiple ranges are provided, the same rules apply as for the multi-range notifications
+    //! such as ARAModelUpdateControllerInterface::notifyAudioSourceContentRangesChanged().
+    const ARAContentTimeRange * ranges;
+
+    //! Content update flags for content change updates, 0 for other update kinds.
+    ARAContentUpdateFlags flags;
+
+    //! Progress state for analysis progress updates, kARAAnalysisProgressUpdated for other update kinds.
+    ARAAnalysisProgressState progressState;
+
+    //! Progress value for analysis progress updates, 0.0f for other update kinds.
+    float progressValue;
+} ARAModelUpdate;
+
+//@}
+
+
 //! Host interface: model update controller.
 //! As with all host interfaces, the function pointers in this struct must remain valid until
 //! all document controllers on the plug-in side that use it have been destroyed.
@@ -2069,7 +2598,7 @@ typedef struct ARAModelUpdateControllerInterface
 
     //! Message to the host signaling analysis progress, value ranges from 0.0f to 1.0f.
     //! The first message must be marked with kARAAnalysisProgressStarted, the last
-    //! with kARAAnalysisProgressCompleted.
+    //! with kARAAnalysisProgressCompleted (or kARAAnalysisProgressCancelled, see there).
     //! This notification is intended solely for displaying a progress indication if desired, but
     //! not to trigger content reading for updating content information. That is instead done when
     //! receiving notifyAudioSourceContentChanged(), see below.
@@ -2144,6 +2673,63 @@ typedef struct ARAModelUpdateControllerInterface
     //! Plug-ins must send this notification reliably to avoid data loss when hosts rely on it in
     //! order to optimize saving ARA data only when it has actually changed.
     ARA_ADDENDUM(2_3_Final) void (ARA_CALL *notifyDocumentDataChanged) (ARAModelUpdateControllerHostRef controllerHostRef);
+
+//! @name Content changes affecting multiple time ranges
+//! A single time range can only express a local edit, so plug-ins that apply several unrelated
+//! edits between two calls to ARADocumentControllerInterface::notifyModelUpdates() would need to
+//! notify the union of all edits, or even the entire object. These optional calls instead take a
+//! list of ranges, so that hosts can update any cached content at a cost proportional to the edit
+//! rather than to the size of the object.
+//! Each call is equivalent to calling the respective single-range notification for each range with
+//! the same flags. In addition, the ranges must fully cover the changes: all events that have been
+//! inserted, modified or removed must intersect with at least one of the ranges in their previous
+//! and in their new state (e.g. when moving a note, both its old and new location must be covered).
+//! This allows hosts to incrementally update their copy of the content by removing all cached
+//! events that intersect any of the ranges, then creating a range-restricted content reader for
+//! each range and adding all events read that intersect the respective range (skipping those that
+//! also intersect an earlier range, since they have already been added).
+//! The ranges may be given in any order and may overlap, rangesCount must not be 0. The pointer to
+//! the ranges is only valid for the duration of the call.
+//! Plug-ins can only make these calls if the host implements all of them.
+//@{
+    //! Multi-range variant of notifyAudioSourceContentChanged().
+    ARA_DRAFT void (ARA_CALL *notifyAudioSourceContentRangesChanged) (ARAModelUpdateControllerHostRef controllerHostRef, ARAAudioSourceHostRef audioSourceHostRef,
+                                                                      ARASize rangesCount, const ARAContentTimeRange ranges[], ARAContentUpdateFlags flags);
+
+    //! Multi-range variant of notifyAudioModificationContentChanged().
+    ARA_DRAFT void (ARA_CALL *notifyAudioModificationContentRangesChanged) (ARAModelUpdateControllerHostRef controllerHostRef, ARAAudioModificationHostRef audioModificationHostRef,
+                                                                            ARASize rangesCount, const ARAContentTimeRange ranges[], ARAContentUpdateFlags flags);
+
+    //! Multi-range variant of notifyPlaybackRegionContentChanged().
+    ARA_DRAFT void (ARA_CALL *notifyPlaybackRegionContentRangesChanged) (ARAModelUpdateControllerHostRef controllerHostRef, ARAPlaybackRegionHostRef playbackRegionHostRef,
+                                                                         ARASize rangesCount, const ARAContentTimeRange ranges[], ARAContentUpdateFlags flags);
+//@}
+
+//! @name Batched notifications
+//! While many analyses are running concurrently, plug-ins may need to deliver thousands of
+//! individual notifications per call to ARADocumentControllerInterface::notifyModelUpdates().
+//! This optional call allows for delivering all of them at once, which also enables plug-ins to
+//! coalesce redundant notifications before delivering them.
+//@{
+    //! Deliver a batch of model update notifications.
+    //! The batch is equivalent to making the individual notification calls in the order of the
+    //! updates array. Plug-ins should coalesce the notifications they collect between two calls to
+    //! notifyModelUpdates(): progress updates can be reduced to the latest value per audio source,
+    //! but all updates with the states kARAAnalysisProgressStarted, kARAAnalysisProgressCompleted
+    //! and kARAAnalysisProgressCancelled must be preserved (e.g. a cancellation followed by a new
+    //! start of an analysis of the same audio source must both be delivered). Further, multiple
+    //! content changes for the same object can be merged into a single update that lists all of
+    //! their ranges separately (rather than their union, so that hosts can update their content
+    //! incrementally) and uses the intersection of their flags. If any of the merged changes affects
+    //! the entire object, the merged update affects the entire object too.
+    //! Hosts that implement this call must handle updates with multiple ranges even if they do not
+    //! implement the multi-range notifications such as notifyAudioSourceContentRangesChanged().
+    //! All pointers in the updates array are only valid for the duration of the call.
+    //! Plug-ins can only use this call if the host implements it, but may still use the individual
+    //! calls even if it is implemented, e.g. if only a single notification is pending.
+    ARA_DRAFT void (ARA_CALL *notifyModelUpdateBatch) (ARAModelUpdateControllerHostRef controllerHostRef,
+                                                       ARASize updatesCount, const ARAModelUpdate updates[]);
+//@}
 } ARAModelUpdateControllerInterface;
 
 // Convenience constant for easy struct validation.
@@ -2390,6 +2976,11 @@ ARA_ADDENDUM(2_0_Final) typedef struct ARAStoreObjectsFilter
 
 // Convenience constant for easy struct validation.
 enum ARA_ADDENDUM(2_0_Final) { kARAStoreObjectsFilterMinSize = ARA_IMPLEMENTED_STRUCT_SIZE(ARAStoreObjectsFilter, audioModificationRefs) };
+
+//! Archive revision: counter to determine whether the persistent state of an object has changed
+//! since it was last stored.
+//! See ARADocumentControllerInterface::getAudioSourceArchiveRevision() for details.
+ARA_DRAFT typedef ARAInt64 ARAArchiveRevision;
 //! @}
 
 
@@ -2450,6 +3041,168 @@ enum ARA_ADDENDUM(2_0_Final) { kARAProcessingAlgorithmPropertiesMinSize = ARA_IM
 //! Reference to the plug-in side representation of a document controller (opaque to the host).
 typedef ARA_REF(ARADocumentControllerRef);
 
+
+//! @name Batched model graph edits
+//! Types used by ARADocumentControllerInterface::applyModelGraphEditBatch().
+//@{
+
+//! Types of model graph edits, each mapping to the according individual document controller call.
+ARA_DRAFT typedef ARA_32_BIT_ENUM(ARAModelGraphEditType)
+{
+    //! Equivalent to ARADocumentControllerInterface::updateDocumentProperties().
+    kARAModelGraphEditUpdateDocumentProperties = 0,
+
+    //! Equivalent to ARADocumentControllerInterface::createMusicalContext().
+    kARAModelGraphEditCreateMusicalContext = 1,
+    //! Equivalent to ARADocumentControllerInterface::updateMusicalContextProperties().
+    kARAModelGraphEditUpdateMusicalContextProperties = 2,
+    //! Equivalent to ARADocumentControllerInterface::destroyMusicalContext().
+    kARAModelGraphEditDestroyMusicalContext = 3,
+
+    //! Equivalent to ARADocumentControllerInterface::createRegionSequence().
+    kARAModelGraphEditCreateRegionSequence = 4,
+    //! Equivalent to ARADocumentControllerInterface::updateRegionSequenceProperties().
+    kARAModelGraphEditUpdateRegionSequenceProperties = 5,
+    //! Equivalent to ARADocumentControllerInterface::destroyRegionSequence().
+    kARAModelGraphEditDestroyRegionSequence = 6,
+
+    //! Equivalent to ARADocumentControllerInterface::createAudioSource().
+    kARAModelGraphEditCreateAudioSource = 7,
+    //! Equivalent to ARADocumentControllerInterface::updateAudioSourceProperties().
+    kARAModelGraphEditUpdateAudioSourceProperties = 8,
+    //! Equivalent to ARADocumentControllerInterface::destroyAudioSource().
+    kARAModelGraphEditDestroyAudioSource = 9,
+
+    //! Equivalent to ARADocumentControllerInterface::createAudioModification().
+    kARAModelGraphEditCreateAudioModification = 10,
+    //! Equivalent to ARADocumentControllerInterface::updateAudioModificationProperties().
+    kARAModelGraphEditUpdateAudioModificationProperties = 11,
+    //! Equivalent to ARADocumentControllerInterface::destroyAudioModification().
+    kARAModelGraphEditDestroyAudioModification = 12,
+
+    //! Equivalent to ARADocumentControllerInterface::createPlaybackRegion().
+    kARAModelGraphEditCreatePlaybackRegion = 13,
+    //! Equivalent to ARADocumentControllerInterface::updatePlaybackRegionProperties().
+    kARAModelGraphEditUpdatePlaybackRegionProperties = 14,
+    //! Equivalent to ARADocumentControllerInterface::destroyPlaybackRegion().
+    kARAModelGraphEditDestroyPlaybackRegion = 15
+};
+
+//! Single model graph edit inside an ARAModelGraphEditBatch.
+//! Since this struct is used in arrays, it is not versioned - future extensions will be done by
+//! adding new edit types, which can be introduced without breaking the memory layout.
+ARA_DRAFT typedef struct ARAModelGraphEdit
+{
+    //! Type of the edit.
+    ARAModelGraphEditType editType;
+
+    //! Index of an earlier edit in the same batch that creates the object referred to by this edit,
+    //! or -1 if objectRef is used instead (or if the edit type does not refer to any object).
+    //! For update and destroy edits, the referred object is the object to update or destroy.
+    //! For kARAModelGraphEditCreateAudioModification, it is the audio source to associate the new
+    //! audio modification with, and for kARAModelGraphEditCreatePlaybackRegion it is the audio
+    //! modification to associate the new playback region with.
+    //! For all other edit types (kARAModelGraphEditUpdateDocumentProperties,
+    //! kARAModelGraphEditCreateMusicalContext, kARAModelGraphEditCreateRegionSequence and
+    //! kARAModelGraphEditCreateAudioSource), no object is referred to and it must be -1.
+    ARAInt32 objectEditIndex;
+
+    //! Plug-in ref of an object that existed before the batch was applied, or NULL if
+    //! objectEditIndex is used instead. The meaning is the same as described for objectEditIndex,
+    //! the type of the ref must match the edit type (e.g. ARAAudioSourceRef for
+    //! kARAModelGraphEditUpdateAudioSourceProperties).
+    //! Must be NULL for all edit types that do not refer to any object, see #objectEditIndex.
+    const void * objectRef;
+
+    //! Host ref for the object to create, matching the edit type. Must be NULL for update and destroy edits.
+    const void * hostRef;
+
+    //! Properties struct matching the edit type (e.g. ARAAudioSourceProperties for
+    //! kARAModelGraphEditCreateAudioSource). Must be NULL for destroy edits.
+    const void * properties;
+} ARAModelGraphEdit;
+
+//! Batch of model graph edits to be applied in a single call.
+//! @see_Versioned_Structs
+ARA_DRAFT typedef struct ARAModelGraphEditBatch
+{
+    //! @see_Versioned_Structs
+    ARASize structSize;
+
+    //! Number of edits in the batch.
+    ARASize editsCount;
+
+    //! Array of edits, to be applied in the given order.
+    const ARAModelGraphEdit * edits;
+} ARAModelGraphEditBatch;
+
+// Convenience constant for easy struct validation.
+enum ARA_DRAFT { kARAModelGraphEditBatchMinSize = ARA_IMPLEMENTED_STRUCT_SIZE(ARAModelGraphEditBatch, edits) };
+
+//@}
+
+
+//! @name Analysis scheduling
+//! Types used by ARADocumentControllerInterface::requestAudioSourceContentAnalysisWithOptions().
+//@{
+
+//! Priority classes for analysis requests.
+//! Plug-ins should schedule pending analyses so that all requests of a higher priority class are
+//! started before those of a lower class. Within the same class, requests with a deadline should
+//! be preferred, ordered by deadline, followed by the others in the order they were requested.
+ARA_DRAFT typedef ARA_32_BIT_ENUM(ARAAnalysisPriority)
+{
+    //! The analysis results are not expected to be used any time soon, e.g. when the host prepares
+    //! its library of audio files while otherwise idle.
+    kARAAnalysisPriorityIdle = 0,
+
+    //! The analysis results will be needed eventually, but are not currently presented to the user,
+    //! e.g. for audio sources used elsewhere in the arrangement. This is the default priority used
+    //! for analyses requested via requestAudioSourceContentAnalysis().
+    kARAAnalysisPriorityBackground = 1,
+
+    //! The analysis results are needed as soon as possible because the audio source is currently
+    //! visible to the user or used in playback.
+    kARAAnalysisPriorityVisible = 2
+};
+
+//! Analysis request with scheduling options.
+//! @see_Versioned_Structs
+ARA_DRAFT typedef struct ARAContentAnalysisRequest
+{
+    //! @see_Versioned_Structs
+    ARASize structSize;
+
+    //! Number of content types to analyze, must not be 0.
+    ARASize contentTypesCount;
+
+    //! Content types to analyze, with the same restrictions as for requestAudioSourceContentAnalysis().
+    const ARAContentType * contentTypes;
+
+    //! Priority class of the request.
+    ARAAnalysisPriority priority;
+
+    //! Optional deadline, in seconds relative to the time of the request, by which the host would
+    //! like the results to be available. 0.0 if no deadline is specified.
+    //! Plug-ins should take the deadline into account when scheduling but are not required to meet it.
+    ARATimeDuration deadline;
+
+    //! Optional time range of the audio source to analyze, or NULL to analyze the entire audio source.
+    //! If the member is not present because structSize does not include it, NULL is assumed.
+    //! Plug-ins should analyze at least the given range first and notify its results as soon as
+    //! they are available, so that the time until the first results are available depends on the
+    //! size of the range rather than on the duration of the audio source. Depending on their
+    //! algorithms, plug-ins may need to analyze some additional context around the range, and they
+    //! may continue to analyze the remainder of the audio source afterwards with a lower priority.
+    //! Ranges requested for the same audio source and content type accumulate until analyzed.
+    ARA_DRAFT const ARAContentTimeRange * range;
+} ARAContentAnalysisRequest;
+
+// Convenience constant for easy struct validation.
+enum ARA_DRAFT { kARAContentAnalysisRequestMinSize = ARA_IMPLEMENTED_STRUCT_SIZE(ARAContentAnalysisRequest, deadline) };
+
+//@}
+
 //! Plug-in interface: document controller.
 //! The function pointers in this struct must remain valid until the document controller is
 //! destroyed by the host.
@@ -3148,6 +3901,217 @@ typedef struct ARADocumentControllerInterface
     //! adjustment, then the plug-in should maintain this state properly.
     ARA_ADDENDUM(2_0_Final) ARABool (ARA_CALL *isAudioModificationPreservingAudioSourceSignal) (ARADocumentControllerRef controllerRef, ARAAudioModificationRef audioModificationRef);
 //@}
+
+//! @name Bulk Content Reading
+//! These optional functions extend the content reader management section above and follow the
+//! same rules regarding when they may be called.
+//@{
+    //! Copy the data of a consecutive range of events of the given reader into a caller-provided buffer.
+    //! This is equivalent to calling getContentReaderDataForEvent() for each event in the range and
+    //! copying the returned data, but avoids the per-event call overhead - hosts can read e.g. a large
+    //! set of notes with a single call.
+    //! The range [firstEventIndex, firstEventIndex + eventsCount) must be a subrange of the events
+    //! exposed by the reader, and eventsCount must not be 0.
+    //! The buffer must be large enough to hold eventsCount structs of the event class associated
+    //! with the content type of the reader (e.g. ARAContentNote for kARAContentTypeNotes), which
+    //! are stored as a C array, i.e. consecutively with a stride of the size of that struct.
+    //! Any pointers contained in the copied events (such as ARAContentChord::name) are owned by the
+    //! plug-in and must remain valid until the content reader is destroyed.
+    ARA_DRAFT void (ARA_CALL *copyContentReaderDataForEvents) (ARADocumentControllerRef controllerRef, ARAContentReaderRef contentReaderRef,
+                                                               ARAInt32 firstEventIndex, ARAInt32 eventsCount, void * eventsData);
+//@}
+
+//! @name Content Reader Seeking
+//! These optional functions extend the content reader management section above and follow the
+//! same rules regarding when they may be called.
+//@{
+    //! Find the index of the first event of the given reader that is located at or after the given time.
+    //! Implementations can rely on the sort order of the content type and use a binary search.
+    //! This optional call allows for quickly locating events e.g. around the playback position
+    //! without creating a new reader restricted to a time range or repeatedly reading events.
+    //! It may only be used for content types which are sorted by time in seconds:
+    //! kARAContentTypeNotes (by ARAContentNote::startPosition) and kARAContentTypeTempoEntries
+    //! (by ARAContentTempoEntry::timePosition).
+    //! If all events are located before the given position, the event count of the reader is returned.
+    ARA_DRAFT ARAInt32 (ARA_CALL *getContentReaderEventIndexForTime) (ARADocumentControllerRef controllerRef, ARAContentReaderRef contentReaderRef,
+                                                                      ARATimePosition timePosition);
+
+    //! Find the index of the first event of the given reader that is located at or after the given
+    //! musical position.
+    //! This is the equivalent of getContentReaderEventIndexForTime() for content types which are
+    //! sorted by quarter notes:
+    //! kARAContentTypeTempoEntries (by ARAContentTempoEntry::quarterPosition),
+    //! kARAContentTypeBarSignatures, kARAContentTypeKeySignatures and kARAContentTypeSheetChords
+    //! (by their respective position).
+    //! If all events are located before the given position, the event count of the reader is returned.
+    ARA_DRAFT ARAInt32 (ARA_CALL *getContentReaderEventIndexForQuarter) (ARADocumentControllerRef controllerRef, ARAContentReaderRef contentReaderRef,
+                                                                         ARAQuarterPosition quarterPosition);
+//@}
+
+//! @name Content Revisions
+//! Hosts that cache content read from the plug-in can use these optional functions to validate
+//! their cache with a single comparison, instead of needing to perfectly track all change
+//! notifications or to re-read all content e.g. after restoring a document.
+//! The revisions are maintained per object and per content type, and increase whenever anything
+//! observable through the content reading functions changes for the given object and content type,
+//! i.e. the content availability, its grade or the events provided by content readers. They never
+//! decrease during the lifetime of an object. For any given object and content type, equal
+//! revisions imply equal content, while different revisions do not necessarily imply changed content.
+//! These functions follow the same rules regarding when they may be called as the functions in the
+//! content reader management section above, and may be called for any content type. Since hosts
+//! may call them often, plug-ins must be able to return the value without any costly calculation.
+//! Plug-ins must either implement all of these functions or none of them.
+//@{
+    //! Query the current content revision of the given audio source and content type.
+    //! Revisions of audio sources are part of their persistent state: when restoring the state of an
+    //! audio source via restoreObjectsFromArchive(), the revision is restored too if the content is
+    //! restored unaltered. If the content is altered when restoring (e.g. because of conversions
+    //! from older archive formats), the resulting revision must be larger than the archived one.
+    //! This allows hosts to persistently store content caches alongside the plug-in archive.
+    ARA_DRAFT ARAContentRevision (ARA_CALL *getAudioSourceContentRevision) (ARADocumentControllerRef controllerRef,
+                                                                            ARAAudioSourceRef audioSourceRef, ARAContentType contentType);
+
+    //! Query the current content revision of the given audio modification and content type.
+    //! Persistency of the revision is handled the same as for audio sources, see getAudioSourceContentRevision().
+    ARA_DRAFT ARAContentRevision (ARA_CALL *getAudioModificationContentRevision) (ARADocumentControllerRef controllerRef,
+                                                                                  ARAAudioModificationRef audioModificationRef, ARAContentType contentType);
+
+    //! Query the current content revision of the given playback region and content type.
+    //! Since playback regions are not persistent, their revisions are only meaningful during the
+    //! lifetime of the given playback region object.
+    ARA_DRAFT ARAContentRevision (ARA_CALL *getPlaybackRegionContentRevision) (ARADocumentControllerRef controllerRef,
+                                                                               ARAPlaybackRegionRef playbackRegionRef, ARAContentType contentType);
+//@}
+
+//! @name Batched Model Graph Edits
+//! When building or restoring large documents, hosts may need to perform tens of thousands of
+//! individual model graph edits. This optional function allows for submitting many of these edits
+//! in a single call, so that the plug-in can e.g. pre-size its internal containers and process the
+//! edits in a single pass.
+//@{
+    //! Apply a batch of model graph edits.
+    //! The result must be equal to performing the equivalent individual calls in the order of the
+    //! edits array, and the same restrictions apply - in particular, this call must be guarded by
+    //! beginEditing() and endEditing(), and objects must not be referred to anymore when destroying them.
+    //! For each edit, the plug-in stores the ref of the newly created object in the according entry
+    //! of createdObjectRefs, which must provide room for batch->editsCount entries. For edits that
+    //! do not create an object, the according entry is set to NULL. createdObjectRefs may be NULL
+    //! if the batch contains no create edits.
+    //! Note that object refs contained in the properties structs (such as the musical context ref
+    //! in ARAPlaybackRegionProperties) must already be known to the host when submitting the batch,
+    //! so they cannot refer to objects created within the same batch. When restoring documents,
+    //! hosts will thus typically use one batch to create all musical contexts, a second batch for
+    //! region sequences, audio sources and audio modifications, and a third batch for all playback
+    //! regions.
+    ARA_DRAFT void (ARA_CALL *applyModelGraphEditBatch) (ARADocumentControllerRef controllerRef,
+                                                         const ARAModelGraphEditBatch * batch, void * createdObjectRefs[]);
+//@}
+
+//! @name Analysis Scheduling
+//! When working with many audio sources, hosts need to be able to express which analysis results
+//! are needed first, e.g. so that the audio sources currently visible to the user are analyzed
+//! before the remaining ones of a large session, and to stop analyses that are no longer needed,
+//! e.g. when the user quickly browses through many takes.
+//! Plug-ins must either implement all of these functions or none of them.
+//@{
+    //! Explicitly trigger a certain analysis with the given scheduling options.
+    //! Apart from the scheduling options, this call is equivalent to requestAudioSourceContentAnalysis().
+    //! If an analysis of any of the content types is already pending for the given audio source,
+    //! the plug-in updates its priority and deadline accordingly instead of requesting it again.
+    //! The request pointer and all data it refers to may be only valid for the duration of the call.
+    ARA_DRAFT void (ARA_CALL *requestAudioSourceContentAnalysisWithOptions) (ARADocumentControllerRef controllerRef, ARAAudioSourceRef audioSourceRef,
+                                                                             const ARAContentAnalysisRequest * request);
+
+    //! Change the priority of all currently pending analyses for the given audio source, e.g. when
+    //! it scrolls into view or out of view. Any deadlines of these analyses remain unchanged.
+    //! This also affects analyses requested via requestAudioSourceContentAnalysis(), but it has no
+    //! effect on analyses the plug-in decides to perform on its own.
+    ARA_DRAFT void (ARA_CALL *updateAudioSourceContentAnalysisPriority) (ARADocumentControllerRef controllerRef, ARAAudioSourceRef audioSourceRef,
+                                                                         ARAAnalysisPriority priority);
+
+    //! Cancel any pending or ongoing analysis of the given content types for the given audio source.
+    //! Unlike deactivateAudioSourceForUndoHistory() or destroyAudioSource(), this does not affect
+    //! the audio source otherwise, and any content that has already been analyzed remains available.
+    //! Cancelled content types remain incomplete as reported by isAudioSourceContentAnalysisIncomplete()
+    //! until they are requested again (or the plug-in decides to analyze them on its own later on).
+    //! If, as a result of the call, no more analysis is running for the audio source and its start
+    //! has already been notified, the plug-in concludes the progress notifications with
+    //! kARAAnalysisProgressCancelled as soon as it has actually stopped processing. If other
+    //! content types are still being analyzed, the merged progress continues as usual. Note that
+    //! paused analyses still count as running in this regard, see pauseAudioSourceContentAnalysis().
+    //! Paused analyses can be cancelled too. If no analysis is pending for any of the given content
+    //! types, the call has no effect.
+    //! The contentTypes pointer may be only valid for the duration of the call.
+    ARA_DRAFT void (ARA_CALL *cancelAudioSourceContentAnalysis) (ARADocumentControllerRef controllerRef, ARAAudioSourceRef audioSourceRef,
+                                                                 ARASize contentTypesCount, const ARAContentType contentTypes[]);
+
+    //! Temporarily suspend any pending or ongoing analysis of the given content types for the given
+    //! audio source, e.g. to free CPU resources for rendering while the user is scrubbing.
+    //! Plug-ins should retain intermediate analysis state if feasible so that resuming continues
+    //! where the analysis was paused. No progress updates are sent while paused, and paused
+    //! analyses remain incomplete as reported by isAudioSourceContentAnalysisIncomplete().
+    //! With regard to notifyAudioSourceAnalysisProgress(), paused analyses still count as running:
+    //! pausing does not conclude the progress notifications, and no final state (neither
+    //! kARAAnalysisProgressCompleted nor kARAAnalysisProgressCancelled) may be sent for the audio
+    //! source while any of its analyses is paused. This way, resuming can continue the progress
+    //! notifications with kARAAnalysisProgressUpdated. If all analyses of the audio source are
+    //! paused, the last progress notification remains in effect until they are resumed or cancelled.
+    //! The contentTypes pointer may be only valid for the duration of the call.
+    ARA_DRAFT void (ARA_CALL *pauseAudioSourceContentAnalysis) (ARADocumentControllerRef controllerRef, ARAAudioSourceRef audioSourceRef,
+                                                                ARASize contentTypesCount, const ARAContentType contentTypes[]);
+
+    //! Resume analyses previously paused via pauseAudioSourceContentAnalysis(), with their previous
+    //! priority and deadline. Content types that are not paused are ignored.
+    //! The contentTypes pointer may be only valid for the duration of the call.
+    ARA_DRAFT void (ARA_CALL *resumeAudioSourceContentAnalysis) (ARADocumentControllerRef controllerRef, ARAAudioSourceRef audioSourceRef,
+                                                                 ARASize contentTypesCount, const ARAContentType contentTypes[]);
+
+    //! Query whether the analysis of the given content type is incomplete for the given time range
+    //! of the given audio source, e.g. after requesting a range-limited analysis via
+    //! requestAudioSourceContentAnalysisWithOptions().
+    //! While only parts of an audio source have been analyzed, isAudioSourceContentAnalysisIncomplete()
+    //! keeps returning kARATrue, but isAudioSourceContentAvailable() may already return kARATrue.
+    //! Hosts should then only rely on the events of content readers restricted to ranges for which
+    //! this call returns kARAFalse.
+    //! The time range may be NULL, which is equivalent to calling isAudioSourceContentAnalysisIncomplete().
+    //! Completion of a range will be notified via ARAModelUpdateControllerInterface::notifyAudioSourceContentChanged()
+    //! as usual, with a time range that covers the analyzed range.
+    ARA_DRAFT ARABool (ARA_CALL *isAudioSourceContentAnalysisIncompleteForRange) (ARADocumentControllerRef controllerRef, ARAAudioSourceRef audioSourceRef,
+                                                                                  ARAContentType contentType, const ARAContentTimeRange * range);
+//@}
+
+//! @name Incremental Archiving
+//! Using partial persistency, hosts can store the state of each audio source and audio modification
+//! and the private document data in separate archives, see storeObjectsToArchive(). If the host
+//! keeps these archives separately in its document, it can save the document incrementally by only
+//! storing those archives again that have changed since the last save, and referencing the archives
+//! of the previous save for all other objects (the details of this referencing are up to the host).
+//! These optional functions allow hosts to determine which archives need to be stored again: when
+//! storing an archive for an object, the host also keeps the current archive revision of the
+//! object. When saving the next time, it only needs to store the object again if its revision differs.
+//! The revisions increase whenever any of the state that the plug-in would store for the given
+//! object changes, and never decrease during the lifetime of an object. Equal revisions imply
+//! that storing the object again would create an equivalent archive, while different revisions do
+//! not necessarily imply that the archive would be different.
+//! Revisions are part of the persistent state of the objects, and are restored along with them via
+//! restoreObjectsFromArchive(). If the state is altered when restoring (e.g. because of conversions
+//! from older archive formats, or because the archive was created with a different document
+//! archive ID), the resulting revision must be larger than the archived one, so that hosts will
+//! store the updated state with the next save.
+//! These functions may only be called on the ARA model thread while the document is not being edited.
+//! Since hosts may call them for all objects upon each save, plug-ins must be able to return the
+//! value without any costly calculation.
+//! Plug-ins must either implement all of these functions or none of them.
+//@{
+    //! Query the current archive revision of the given audio source.
+    ARA_DRAFT ARAArchiveRevision (ARA_CALL *getAudioSourceArchiveRevision) (ARADocumentControllerRef controllerRef, ARAAudioSourceRef audioSourceRef);
+
+    //! Query the current archive revision of the given audio modification.
+    ARA_DRAFT ARAArchiveRevision (ARA_CALL *getAudioModificationArchiveRevision) (ARADocumentControllerRef controllerRef, ARAAudioModificationRef audioModificationRef);
+
+    //! Query the current archive revision of the private document data, see ARAStoreObjectsFilter::documentData.
+    ARA_DRAFT ARAArchiveRevision (ARA_CALL *getDocumentDataArchiveRevision) (ARADocumentControllerRef controllerRef);
+//@}
 } ARADocumentControllerInterface;
 
 // Convenience constant for easy struct validation.